@@ -2,20 +2,23 @@
 // Author: trietruo
 // Description: Implements a game of Boggle from two files (board file and dictionary file)
 //     including functions to solve for and print found words
-// Last Changed: 4.24.2023
+// Last Changed: 10.19.2026
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <stdexcept>
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <thread>
 #include "Boggle.h"
 
 
 // Constructor
 // pre: two input streams are prepared
 // post: the board is set as designated and the dictionary is imported into a Trie
-Boggle::Boggle(std::ifstream &infile1, std::ifstream &infile2)
+Boggle::Boggle(std::ifstream &infile1, std::ifstream &infile2) : keepAllPaths(false)
 {
     // Open and load characters into the boggleBoard matrix
     openFile(infile1, BOARD_NAME);
@@ -78,6 +81,178 @@ void Boggle::solve(std::string word, size_t nextR, size_t nextC)
     visitedBoard[nextR][nextC] = false;
 }
 
+// Solving function like solve that also records each found word's score and the
+// packed path of tiles used to spell it
+// pre: the board is set as designated and the dictionary is imported; the first
+//     call should have word be "" and path be all zeros
+// post: scoredWords is loaded with all the found words from the starting point
+void Boggle::solveScored(std::string word, PackedPath path, size_t nextR, size_t nextC)
+{
+    // Search using the board's visited tiles, then record the words in the order they
+    // were found
+    std::vector<FoundPath> found;
+    solveTask(word, path, nextR, nextC, visitedBoard, found);
+
+    for (size_t i = 0; i < found.size(); ++i) {
+        addScoredWord(found[i].word, found[i].path);
+    }
+}
+
+// Solves the whole board like calling solveScored from every square, but splits the
+// search into one task per starting square and first neighbor and runs the tasks on
+// threadCount threads; each task keeps its own visited tiles and results, which are
+// merged in task order once all threads finish so the output matches solveScored
+// pre: the board is set as designated and the dictionary is imported; a threadCount
+//     of 0 is treated as 1
+// post: scoredWords is loaded with all the found words
+void Boggle::solveParallel(unsigned threadCount)
+{
+    // Build the tasks in the same order solveScored visits them
+    std::vector<size_t> taskStarts;
+    std::vector<size_t> taskNexts;
+    for (size_t r = 0; r < SIZE; ++r) {
+        for (size_t c = 0; c < SIZE; ++c) {
+            for (int i = -1; i <= 1; ++i) {
+                for (int j = -1; j <= 1; ++j) {
+                    size_t nextR = r + i;
+                    size_t nextC = c + j;
+                    if (nextR < SIZE && nextC < SIZE && (i != 0 || j != 0)) {
+                        taskStarts.push_back(r * SIZE + c);
+                        taskNexts.push_back(nextR * SIZE + nextC);
+                    }
+                }
+            }
+        }
+    }
+
+    // Each task writes only to its own slot, so no locking is needed; threads claim
+    // tasks from a shared counter, and there is no use for more threads than tasks
+    std::vector<std::vector<FoundPath> > taskResults(taskStarts.size());
+    std::atomic<size_t> nextTask(0);
+    size_t threadTotal = std::min<size_t>(threadCount, taskStarts.size());
+    if (threadTotal == 0) {
+        threadTotal = 1;
+    }
+
+    std::vector<std::thread> threads;
+    try {
+        for (size_t t = 0; t < threadTotal; ++t) {
+            threads.push_back(std::thread([&]() {
+                bool visited[SIZE][SIZE] = {};
+                for (size_t task = nextTask++; task < taskStarts.size(); task = nextTask++) {
+                    size_t startR = taskStarts[task] / SIZE;
+                    size_t startC = taskStarts[task] % SIZE;
+                    PackedPath path = PackedPath();
+                    setPathCell(path, 0, taskStarts[task]);
+
+                    visited[startR][startC] = true;
+                    solveTask(std::string(1, boggleBoard[startR][startC]), path,
+                            taskNexts[task] / SIZE, taskNexts[task] % SIZE, visited,
+                            taskResults[task]);
+                    visited[startR][startC] = false;
+                }
+            }));
+        }
+    } catch (...) {
+        // Threads that already started must be joined before they are destroyed; they
+        // finish the remaining tasks before the error is passed on
+        for (size_t t = 0; t < threads.size(); ++t) {
+            threads[t].join();
+        }
+        throw;
+    }
+
+    for (size_t t = 0; t < threads.size(); ++t) {
+        threads[t].join();
+    }
+
+    // Merge the results in task order
+    for (size_t task = 0; task < taskResults.size(); ++task) {
+        for (size_t i = 0; i < taskResults[task].size(); ++i) {
+            addScoredWord(taskResults[task][i].word, taskResults[task][i].path);
+        }
+    }
+}
+
+// Sets whether solveScored and solveParallel keep every distinct path of a word or
+// only the first one found; defaults to false
+void Boggle::setKeepAllPaths(bool keepAll)
+{
+    keepAllPaths = keepAll;
+}
+
+// Returns the words found by solveScored or solveParallel, ordered alphabetically
+const std::map<std::string, ScoredWord>& Boggle::getScoredWords() const
+{
+    return scoredWords;
+}
+
+// Prints out the words found by solveScored or solveParallel alphabetically with
+// their scores and paths, and how many words
+void Boggle::printScoredWords()
+{
+    std::string amountWords = std::to_string(scoredWords.size());
+
+    std::cout << "The computer found the following words:" << std::endl;
+    std::cout << "============" << std::endl;
+
+    for (std::map<std::string, ScoredWord>::const_iterator it = scoredWords.begin();
+            it != scoredWords.end(); ++it) {
+        const std::string &word = it->first;
+        const ScoredWord &result = it->second;
+        std::cout << word << " (" << result.score << ")";
+
+        // Each path is printed as its tiles' (row,column) coordinates
+        for (size_t p = 0; p <= result.morePaths.size(); ++p) {
+            const PackedPath &path = (p == 0 ? result.path : result.morePaths[p - 1]);
+            std::cout << (p == 0 ? " " : " | ");
+            for (size_t i = 0; i < word.length(); ++i) {
+                size_t cell = pathCell(path, i);
+                std::cout << "(" << cell / SIZE << "," << cell % SIZE << ")";
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << "============" << std::endl;
+    std::cout << "The computer found " + amountWords;
+    if (amountWords == "1") {
+        std::cout << " word." << std::endl;
+    } else {
+        std::cout << " words." << std::endl;
+    }
+}
+
+// Returns the official Boggle score of a word: 1 point for 3 or 4 letters, 2 for 5,
+// 3 for 6, 5 for 7, and 11 for 8 or more
+int Boggle::scoreWord(const std::string& word)
+{
+    switch (word.length()) {
+    case 0:
+    case 1:
+    case 2:
+        return 0;
+    case 3:
+    case 4:
+        return 1;
+    case 5:
+        return 2;
+    case 6:
+        return 3;
+    case 7:
+        return 5;
+    default:
+        return 11;
+    }
+}
+
+// Returns the board cell index (r * SIZE + c) at position i of a packed path
+size_t Boggle::pathCell(const PackedPath& path, size_t i)
+{
+    uint64_t mask = (uint64_t(1) << CELL_BITS) - 1;
+    return (path[i / CELLS_PER_WORD] >> (i % CELLS_PER_WORD * CELL_BITS)) & mask;
+}
+
 // Prints out the found words alphabetically and how many words; prints
 // different Tries depending on whether userInput is true or false
 // pre: true or false is set depending on if the user's information should be printed
@@ -195,3 +370,79 @@ bool Boggle::isOnBoard(std::string word, size_t curR, size_t curC) {
 
     return false;
 }
+
+// Helper function that stores a board cell index at position i of a packed path
+// pre: i is less than SIZE * SIZE and cell is a valid cell index
+// post: position i of the path holds cell
+void Boggle::setPathCell(PackedPath &path, size_t i, size_t cell)
+{
+    uint64_t mask = (uint64_t(1) << CELL_BITS) - 1;
+    size_t shift = i % CELLS_PER_WORD * CELL_BITS;
+    uint64_t &bits = path[i / CELLS_PER_WORD];
+    bits = (bits & ~(mask << shift)) | (uint64_t(cell) << shift);
+}
+
+// Helper function that records a word found along path in scoredWords, adding the
+//     path to an already found word only if all paths are kept
+// pre: word is a valid word of at least 4 characters the user did not find
+// post: the word (and possibly its path) is recorded
+void Boggle::addScoredWord(const std::string &word, const PackedPath &path)
+{
+    std::map<std::string, ScoredWord>::iterator found = scoredWords.find(word);
+    if (found == scoredWords.end()) {
+        ScoredWord result;
+        result.score = scoreWord(word);
+        result.path = path;
+        scoredWords.insert(std::make_pair(word, result));
+    } else if (keepAllPaths) {
+        found->second.morePaths.push_back(path);
+    }
+}
+
+// Helper function for solveScored and solveParallel that searches for words from a
+// starting point but only reads the shared state; visited and found belong to the
+//     caller
+// pre: the same as solveScored, with visited marking the tiles already in word
+// post: found holds every valid word reached from the starting point in the order they
+//     were found, with every path only if all paths are kept
+void Boggle::solveTask(std::string word, PackedPath path, size_t nextR, size_t nextC,
+        bool visited[SIZE][SIZE], std::vector<FoundPath> &found) const
+{
+    if (nextR >= SIZE || nextC >= SIZE) { // If out of bounds, stop
+        return;
+    } else if (visited[nextR][nextC]) { // If it's visited, stop
+        return;
+    } else if (!validWords.isPrefix(word)) { // If it's not valid, stop
+        return;
+    }
+
+    visited[nextR][nextC] = true;
+    setPathCell(path, word.length(), nextR * SIZE + nextC);
+    word += boggleBoard[nextR][nextC];
+
+    // Records the word if it is valid and the user did not find it; unless all paths
+    // are kept, a word this task already found is skipped (a task finds few words, so
+    // a linear search is enough)
+    if (word.length() >= 4 && validWords.isWord(word) && !userFoundWords.isWord(word)) {
+        bool seen = false;
+        for (size_t i = 0; !keepAllPaths && !seen && i < found.size(); ++i) {
+            seen = found[i].word == word;
+        }
+
+        if (!seen) {
+            FoundPath result;
+            result.word = word;
+            result.path = path;
+            found.push_back(result);
+        }
+    }
+
+    // Solve on all the adjacent points
+    for (int i = -1; i <= 1; ++i) {
+        for (int j = -1; j <= 1; ++j) {
+            solveTask(word, path, nextR + i, nextC + j, visited, found);
+        }
+    }
+
+    visited[nextR][nextC] = false;
+}
@@ -2,19 +2,55 @@
 // Author: trietruo
 // Description: Declares a game of Boggle from two files (board file and dictionary file)
 //     including functions to solve for and print found words
-// Last Changed: 4.24.2023
+// Last Changed: 10.19.2026
 
 #ifndef BOGGLE_H
 #define BOGGLE_H
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <map>
 #include <stdexcept>
 #include <string>
+#include <vector>
 #include "Trie.h"
 
 
 const std::string BOARD_NAME("boggle-in.txt");
 const std::string DICTIONARY_NAME("ospd.txt");
-const int SIZE(4);
+// The board is SIZE x SIZE; build with -DBOGGLE_SIZE=n to play on a larger board
+#ifndef BOGGLE_SIZE
+#define BOGGLE_SIZE 4
+#endif
+const int SIZE(BOGGLE_SIZE);
+
+// Returns the number of bits needed to store a value in the range [0, n)
+constexpr int bitsFor(int n)
+{
+    return n <= 1 ? 0 : 1 + bitsFor((n + 1) / 2);
+}
+
+// A path is packed as one cell index (r * SIZE + c) per letter, CELL_BITS bits each,
+// with the first letter in the lowest bits; a 4x4 board fits in a single 64-bit integer
+const int CELL_BITS(bitsFor(SIZE * SIZE));
+const int CELLS_PER_WORD(64 / CELL_BITS);
+const int PATH_WORDS((SIZE * SIZE + CELLS_PER_WORD - 1) / CELLS_PER_WORD);
+typedef std::array<uint64_t, PATH_WORDS> PackedPath;
+
+// The official Boggle score of a word the computer found and the packed tile path(s)
+// that spell it; the word itself is the key it is stored under, and the path length
+// is the word length
+struct ScoredWord {
+    int score;
+    PackedPath path; // The first path found
+    std::vector<PackedPath> morePaths; // Other distinct paths, if all paths are kept
+};
+
+// A word a solveParallel task found and the packed tile path that spells it
+struct FoundPath {
+    std::string word;
+    PackedPath path;
+};
 
 class Boggle {
 private:
@@ -23,6 +59,8 @@ private:
     Trie validWords; // Dictionary-imported Trie (ospd.txt)
     Trie foundWords; // Words the computer found
     Trie userFoundWords; // Words the user found
+    std::map<std::string, ScoredWord> scoredWords; // Found words with scores and paths
+    bool keepAllPaths; // Whether scored solving keeps every distinct path or just the first
 
     // Helper function that opens files for the constructor; throws std::runtime_error if
     // file fails to open
@@ -35,6 +73,26 @@ private:
     // post: returns true if the word is possible and false otherwise
     bool isOnBoard(std::string word, size_t curR, size_t curC);
 
+    // Helper function that stores a board cell index at position i of a packed path
+    // pre: i is less than SIZE * SIZE and cell is a valid cell index
+    // post: position i of the path holds cell
+    static void setPathCell(PackedPath &path, size_t i, size_t cell);
+
+    // Helper function that records a word found along path in scoredWords, adding the
+    //     path to an already found word only if all paths are kept
+    // pre: word is a valid word of at least 4 characters the user did not find
+    // post: the word (and possibly its path) is recorded
+    void addScoredWord(const std::string &word, const PackedPath &path);
+
+    // Helper function for solveScored and solveParallel that searches for words from a
+    // starting point but only reads the shared state; visited and found belong to the
+    //     caller
+    // pre: the same as solveScored, with visited marking the tiles already in word
+    // post: found holds every valid word reached from the starting point in the order they
+    //     were found, with every path only if all paths are kept
+    void solveTask(std::string word, PackedPath path, size_t nextR, size_t nextC,
+            bool visited[SIZE][SIZE], std::vector<FoundPath> &found) const;
+
     void isOnBoard2(std::string word, size_t curR, size_t curC);
 
 
@@ -52,6 +110,40 @@ public:
     //     starting point
     void solve(std::string word, size_t nextR, size_t nextC);
 
+    // Solving function like solve that also records each found word's score and the
+    // packed path of tiles used to spell it
+    // pre: the board is set as designated and the dictionary is imported; the first
+    //     call should have word be "" and path be all zeros
+    // post: scoredWords is loaded with all the found words from the starting point
+    void solveScored(std::string word, PackedPath path, size_t nextR, size_t nextC);
+
+    // Solves the whole board like calling solveScored from every square, but splits the
+    // search into one task per starting square and first neighbor and runs the tasks on
+    // threadCount threads; each task keeps its own visited tiles and results, which are
+    // merged in task order once all threads finish so the output matches solveScored
+    // pre: the board is set as designated and the dictionary is imported; a threadCount
+    //     of 0 is treated as 1
+    // post: scoredWords is loaded with all the found words
+    void solveParallel(unsigned threadCount);
+
+    // Sets whether solveScored and solveParallel keep every distinct path of a word or
+    // only the first one found; defaults to false
+    void setKeepAllPaths(bool keepAll);
+
+    // Returns the words found by solveScored or solveParallel, ordered alphabetically
+    const std::map<std::string, ScoredWord>& getScoredWords() const;
+
+    // Prints out the words found by solveScored or solveParallel alphabetically with
+    // their scores and paths, and how many words
+    void printScoredWords();
+
+    // Returns the official Boggle score of a word: 1 point for 3 or 4 letters, 2 for 5,
+    // 3 for 6, 5 for 7, and 11 for 8 or more
+    static int scoreWord(const std::string& word);
+
+    // Returns the board cell index (r * SIZE + c) at position i of a packed path
+    static size_t pathCell(const PackedPath& path, size_t i);
+
     // Prints out the found words alphabetically and how many words; prints
     // different Tries depending on whether userInput is true or false
     // pre: true or false is set depending on if the user's information should be printed
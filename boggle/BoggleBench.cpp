@@ -0,0 +1,230 @@
+// File Name: BoggleBench.cpp
+// Author: trietruo
+// Description: Times the Boggle solvers on the board in boggle-in.txt; reports the
+//     word-only and scored single-threaded solves and solveParallel at a doubling
+//     number of threads, so the latency curve can be rebuilt for each board size, and
+//     the memory held by the scored results
+// Last Changed: 10.19.2026
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include "Boggle.h"
+
+
+// Every allocation made through operator new is counted so the memory held by the
+// results can be measured; each block starts with a header storing its size
+const size_t BLOCK_HEADER(alignof(std::max_align_t));
+std::atomic<size_t> liveBlocks(0);
+std::atomic<size_t> liveBytes(0);
+
+void* operator new(size_t size)
+{
+    char *block = static_cast<char*>(std::malloc(size + BLOCK_HEADER));
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    *reinterpret_cast<size_t*>(block) = size;
+    ++liveBlocks;
+    liveBytes += size;
+    return block + BLOCK_HEADER;
+}
+
+void operator delete(void *pointer) noexcept
+{
+    if (pointer == nullptr) {
+        return;
+    }
+
+    char *block = static_cast<char*>(pointer) - BLOCK_HEADER;
+    --liveBlocks;
+    liveBytes -= *reinterpret_cast<size_t*>(block);
+    std::free(block);
+}
+
+// The solvers that can be timed; THREADED runs solveParallel
+enum SolveMode { WORDS_ONLY, SCORED, THREADED };
+
+// Times one solve of the whole board on a freshly loaded game, so earlier runs do not
+// leave words behind; loading the files is not timed
+// pre: boggle-in.txt and ospd.txt are in the working directory
+// post: returns the solve time in milliseconds and sets wordCount to the words found
+double timeSolve(SolveMode mode, unsigned threadCount, size_t &wordCount)
+{
+    std::ifstream infile1;
+    std::ifstream infile2;
+    Boggle boggleGame(infile1, infile2);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (mode == THREADED) {
+        boggleGame.solveParallel(threadCount);
+    } else {
+        for (size_t r = 0; r < SIZE; ++r) {
+            for (size_t c = 0; c < SIZE; ++c) {
+                if (mode == WORDS_ONLY) {
+                    boggleGame.solve("", r, c);
+                } else {
+                    boggleGame.solveScored("", PackedPath(), r, c);
+                }
+            }
+        }
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    wordCount = boggleGame.getScoredWords().size();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Returns the fastest of repeats timed solves
+double bestSolve(SolveMode mode, unsigned threadCount, int repeats, size_t &wordCount)
+{
+    double best = timeSolve(mode, threadCount, wordCount);
+    for (int i = 1; i < repeats; ++i) {
+        double time = timeSolve(mode, threadCount, wordCount);
+        if (time < best) {
+            best = time;
+        }
+    }
+
+    return best;
+}
+
+// Prints the memory held by the results of a scored solve of the whole board: the
+// heap blocks and bytes that are still allocated once the solve returns; allocator
+// bookkeeping for each block is not included
+// pre: boggle-in.txt and ospd.txt are in the working directory
+// post: the report is printed
+void reportMemory(bool keepAll)
+{
+    std::ifstream infile1;
+    std::ifstream infile2;
+    Boggle boggleGame(infile1, infile2);
+    boggleGame.setKeepAllPaths(keepAll);
+
+    size_t startBlocks = liveBlocks;
+    size_t startBytes = liveBytes;
+    for (size_t r = 0; r < SIZE; ++r) {
+        for (size_t c = 0; c < SIZE; ++c) {
+            boggleGame.solveScored("", PackedPath(), r, c);
+        }
+    }
+    size_t blocks = liveBlocks - startBlocks;
+    size_t bytes = liveBytes - startBytes;
+
+    const std::map<std::string, ScoredWord> &results = boggleGame.getScoredWords();
+    size_t pathCount = 0;
+    for (std::map<std::string, ScoredWord>::const_iterator it = results.begin();
+            it != results.end(); ++it) {
+        pathCount += 1 + it->second.morePaths.size();
+    }
+
+    std::cout << (keepAll ? "all paths    " : "first path   ") << results.size()
+            << " words, " << pathCount << " paths, " << blocks << " blocks, " << bytes
+            << " bytes";
+    if (!results.empty()) {
+        std::cout << " (" << double(blocks) / results.size() << " blocks and "
+                << bytes / results.size() << " bytes per word)";
+    }
+    std::cout << std::endl;
+}
+
+// Returns how many tasks solveParallel splits the board into: one per starting
+// square and neighbor; more threads than this have nothing to do
+unsigned parallelTaskCount()
+{
+    unsigned count = 0;
+    for (int r = 0; r < SIZE; ++r) {
+        for (int c = 0; c < SIZE; ++c) {
+            for (int i = -1; i <= 1; ++i) {
+                for (int j = -1; j <= 1; ++j) {
+                    if ((i != 0 || j != 0) && r + i >= 0 && r + i < SIZE &&
+                            c + j >= 0 && c + j < SIZE) {
+                        ++count;
+                    }
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+// Reads a positive whole number from a command-line argument
+// pre: text is a null-terminated string
+// post: returns true and sets value if text is a number from 1 to limit; otherwise
+//     returns false and leaves value unchanged
+bool parseCount(const char *text, long limit, long &value)
+{
+    char *end = nullptr;
+    long parsed = std::strtol(text, &end, 10);
+    if (end == text || *end != '\0' || parsed < 1 || parsed > limit) {
+        return false;
+    }
+
+    value = parsed;
+    return true;
+}
+
+// Usage: BoggleBench [max threads] [repeats]; max threads defaults to the number of
+// cores and repeats to 5; max threads is capped at the number of tasks
+int main(int argc, char *argv[]) {
+    const long MAX_REPEATS(1000);
+    long taskCount = parallelTaskCount();
+    long maxThreads = std::thread::hardware_concurrency();
+    long repeats = 5;
+
+    if ((argc > 1 && !parseCount(argv[1], taskCount, maxThreads)) ||
+            (argc > 2 && !parseCount(argv[2], MAX_REPEATS, repeats))) {
+        std::cout << "Usage: BoggleBench [max threads (1-" << taskCount
+                << ")] [repeats (1-" << MAX_REPEATS << ")]" << std::endl;
+        return 1;
+    }
+    if (maxThreads < 1) {
+        maxThreads = 1;
+    } else if (maxThreads > taskCount) {
+        maxThreads = taskCount;
+    }
+
+    // Thread counts double up to maxThreads, which is always included
+    std::vector<unsigned> threadCounts;
+    for (long t = 1; t < maxThreads; t *= 2) {
+        threadCounts.push_back(t);
+    }
+    threadCounts.push_back(maxThreads);
+
+    size_t wordCount = 0;
+    double wordsOnly = bestSolve(WORDS_ONLY, 1, repeats, wordCount);
+    double scored = bestSolve(SCORED, 1, repeats, wordCount);
+
+    std::cout << SIZE << "x" << SIZE << " board, " << wordCount << " words, best of "
+            << repeats << " runs (ms)" << std::endl;
+    std::cout << "============" << std::endl;
+    std::cout << "solve        " << wordsOnly << std::endl;
+    std::cout << "solveScored  " << scored << std::endl;
+
+    // Speedup is measured against the single-threaded scored solve, which gives the
+    // same results
+    for (size_t i = 0; i < threadCounts.size(); ++i) {
+        double time = bestSolve(THREADED, threadCounts[i], repeats, wordCount);
+        std::cout << "threads " << threadCounts[i] << "    " << time << " (speedup "
+                << scored / time << "x)" << std::endl;
+    }
+
+    std::cout << "============" << std::endl;
+    std::cout << "sizeof: PackedPath " << sizeof(PackedPath) << ", ScoredWord "
+            << sizeof(ScoredWord) << ", map entry "
+            << sizeof(std::map<std::string, ScoredWord>::value_type) << std::endl;
+    reportMemory(false);
+    reportMemory(true);
+
+    return 0;
+}
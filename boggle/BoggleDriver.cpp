@@ -2,13 +2,14 @@
 // Author: trietruo
 // Description: Driver utilizing the Boggle class to play a game of Boggle; prompts user
 //     for inputs and the computer solves the rest of the words the user did not find
-// Last Changed: 4.24.2023
+// Last Changed: 10.19.2026
 
 #include <cstddef>
 #include <stdexcept>
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <thread>
 #include "Boggle.h"
 
 
@@ -38,15 +39,12 @@ int main() {
     boggleGame.printFoundWords(true);
     std::cout << std::endl;
 
-    // Solve for the words from each square on the board
-    for (size_t r = 0; r < SIZE; ++r) {
-        for (size_t c = 0; c < SIZE; ++c) {
-            boggleGame.solve("", r, c);
-        }
-    }
+    // Solve for the words from each square on the board using every available core,
+    // recording scores and paths
+    boggleGame.solveParallel(std::thread::hardware_concurrency());
 
     // Print out all computer-found words the user did not find
-    boggleGame.printFoundWords(false);
+    boggleGame.printScoredWords();
 
     return 0;
 }